@@ -0,0 +1,126 @@
+/*
+Test-wires.c
+
+Test driver of libWiReS, in C: opens a wind lattice (or an OpenFOAM case),
+queries one point, then a batch of points around it, checks that the batch
+agrees with single-point queries and prints the cost of both calls.
+
+	Test-wires LATTICE LAT LON H [N]
+	Test-wires -case ROOT CASE LAT LON H [N]
+
+LAT, LON (deg), H (m): a point in the grid; N: batch size (default 10000).
+Exits 1 on failure.
+*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "wires.h"
+
+static double seconds(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+	int arg = 1;
+	wires_field* field;
+	wires_query* query;
+	double lat, lon, h, wind[3], start, point_s, batch_s;
+	double* points;
+	double* winds;
+	int* status;
+	size_t n = 10000, i, in_grid, mismatches = 0;
+
+	if (argc > 1 && strcmp(argv[1], "-case") == 0) {
+		if (argc < 7) {
+			fprintf(stderr, "Usage: %s -case ROOT CASE LAT LON H [N]\n", argv[0]);
+			return 1;
+		}
+		field = wires_open_case(argv[2], argv[3]);
+		arg = 4;
+	}
+	else {
+		if (argc < 5) {
+			fprintf(stderr, "Usage: %s LATTICE LAT LON H [N]\n", argv[0]);
+			return 1;
+		}
+		field = wires_open_lattice(argv[1]);
+		arg = 2;
+	}
+	if (!field) {
+		fprintf(stderr, "Cannot open the wind field: %s\n", wires_last_error());
+		return 1;
+	}
+	lat = atof(argv[arg]);
+	lon = atof(argv[arg + 1]);
+	h = atof(argv[arg + 2]);
+	if (argc > arg + 3)
+		n = strtoul(argv[arg + 3], NULL, 10);
+
+	query = wires_query_new(field);
+	if (!query) {
+		fprintf(stderr, "Cannot create a query: %s\n", wires_last_error());
+		wires_close(field);
+		return 1;
+	}
+
+	if (!wires_query_point(query, 0, lat, lon, h, wind)) {
+		fprintf(stderr, "Point %g %g %g is out of grid\n", lat, lon, h);
+		wires_query_free(query);
+		wires_close(field);
+		return 1;
+	}
+	printf("Wind at %g %g %g: north %f east %f down %f ft/s\n", lat, lon, h, wind[0], wind[1], wind[2]);
+
+	/* a straight path through the point, about 1 m between points */
+	points = (double*)malloc(4*n*sizeof(double));
+	winds = (double*)malloc(3*n*sizeof(double));
+	status = (int*)malloc(n*sizeof(int));
+	if (!points || !winds || !status) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < n; i++) {
+		const double s = (double)i - 0.5*n;
+		points[4*i] = 0.01*i;
+		points[4*i + 1] = lat + 1e-5*s;
+		points[4*i + 2] = lon + 1e-5*s;
+		points[4*i + 3] = h;
+	}
+
+	start = seconds();
+	in_grid = wires_query_batch(query, n, points, winds, status);
+	batch_s = seconds() - start;
+
+	start = seconds();
+	for (i = 0; i < n; i++) {
+		const int in = wires_query_point(query, points[4*i], points[4*i + 1], points[4*i + 2], points[4*i + 3], wind);
+		if (in != status[i] || fabs(wind[0] - winds[3*i]) > 1e-9 || fabs(wind[1] - winds[3*i + 1]) > 1e-9
+			|| fabs(wind[2] - winds[3*i + 2]) > 1e-9)
+			mismatches++;
+	}
+	point_s = seconds() - start;
+
+	printf("%lu points, %lu in grid\n", (unsigned long)n, (unsigned long)in_grid);
+	printf("wires_query_point: %.1f ns/point\n", 1e9*point_s/n);
+	printf("wires_query_batch: %.1f ns/point\n", 1e9*batch_s/n);
+
+	free(points);
+	free(winds);
+	free(status);
+	wires_query_free(query);
+	wires_close(field);
+
+	if (mismatches > 0) {
+		fprintf(stderr, "%lu points differ between wires_query_batch and wires_query_point\n",
+			(unsigned long)mismatches);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,80 @@
+/*
+wires.h
+
+C API of libWiReS: the wind of WRServer, queried in-process (no sockets),
+e.g. from a JSBSim-side adapter.
+
+	wires_field* field = wires_open_lattice("case.lat");
+	if (!field) { fprintf(stderr, "%s\n", wires_last_error()); ... }
+	wires_query* q = wires_query_new(field);
+
+	double wind_ned[3];
+	int in_grid = wires_query_point(q, t, lat, lon, h, wind_ned);
+
+	wires_query_free(q);
+	wires_close(field);
+
+Positions are latitude, longitude (deg) and altitude (m); wind is returned
+as north, east, down components in ft/s (the JSBSim atmosphere/gust-*-fps
+properties), 0 out of grid.
+
+A field is shared, read-only, by any number of threads; a query handle is
+used by one thread at a time (one per aircraft, or per thread). Functions
+returning NULL set a message read by wires_last_error (per thread).
+*/
+#ifndef wires_h
+#define wires_h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct wires_field wires_field;
+typedef struct wires_query wires_query;
+
+/* Wind lattice file baked by WRServer --bake (memory-mapped) */
+wires_field* wires_open_lattice(const char* path);
+
+/* Wind lattice published by a WRServer --shm-create loader; waits up to wait_s seconds */
+wires_field* wires_attach_shared(const char* name, double wait_s);
+
+/* U of the OpenFOAM case root_path/case_name, at the start time of its
+   controlDict; cell lookup with the bucket index. OpenFOAM fatal errors
+   are made to throw (reported as a NULL return) instead of exiting the
+   process, and are left so after the call */
+wires_field* wires_open_case(const char* root_path, const char* case_name);
+
+void wires_close(wires_field* field);
+
+wires_query* wires_query_new(const wires_field* field);
+
+void wires_query_free(wires_query* query);
+
+/* Wind at time t (s), lat, lon (deg), h (m) in wind_ned (ft/s);
+   returns 1 if the point is in grid, 0 otherwise (then the wind is 0) */
+int wires_query_point(wires_query* query, double t, double lat, double lon, double h, double wind_ned[3]);
+
+/* n points, points[4*i] = { t, lat, lon, h }, winds in wind_ned[3*i];
+   status[i] (if status is not NULL) as wires_query_point;
+   returns the number of points in grid */
+size_t wires_query_batch(wires_query* query, size_t n, const double* points, double* wind_ned, int* status);
+
+/* Messages of the library written to stdout, by the calling thread, from
+   level "debug", "info", "warning", "error" or "none" (the default);
+   returns 0 if level is not one of these */
+int wires_set_log_level(const char* level);
+
+/* Per-stage timing and counters of the queries (WRMetrics.H), off by
+   default */
+void wires_set_metrics(int enabled);
+
+/* Message of the last failure of this thread */
+const char* wires_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif